@@ -9,14 +9,16 @@ private:
     T amount;  
 
 public:
-    Money() : amount(0) {}
-    explicit Money(T value) : amount(value) {}
+    using value_type = T;
 
+    constexpr Money() : amount(0) {}
+    constexpr explicit Money(T value) : amount(value) {}
 
-    Money(const Money& other) : amount(other.amount) {}
+
+    constexpr Money(const Money& other) : amount(other.amount) {}
 
    
-    Money& operator=(const Money& other) {
+    constexpr Money& operator=(const Money& other) {
         if (this != &other) {
             amount = other.amount;
         }
@@ -24,27 +26,27 @@ public:
     }
 
     
-    operator T() const { return amount; }
+    constexpr operator T() const { return amount; }
 
  
-    Money operator+(const Money& other) const { return Money(amount + other.amount); }
-    Money operator-(const Money& other) const { return Money(amount - other.amount); }
-    Money operator*(double factor) const { return Money(static_cast<T>(amount * factor)); }
-    Money operator/(double divisor) const { return Money(static_cast<T>(amount / divisor)); }
+    constexpr Money operator+(const Money& other) const { return Money(amount + other.amount); }
+    constexpr Money operator-(const Money& other) const { return Money(amount - other.amount); }
+    constexpr Money operator*(double factor) const { return Money(static_cast<T>(amount * factor)); }
+    constexpr Money operator/(double divisor) const { return Money(static_cast<T>(amount / divisor)); }
 
   
-    bool operator<(const Money& other) const { return amount < other.amount; }
-    bool operator>(const Money& other) const { return amount > other.amount; }
-    bool operator<=(const Money& other) const { return amount <= other.amount; }
-    bool operator>=(const Money& other) const { return amount >= other.amount; }
-    bool operator==(const Money& other) const { return amount == other.amount; }
-    bool operator!=(const Money& other) const { return amount != other.amount; }
+    constexpr bool operator<(const Money& other) const { return amount < other.amount; }
+    constexpr bool operator>(const Money& other) const { return amount > other.amount; }
+    constexpr bool operator<=(const Money& other) const { return amount <= other.amount; }
+    constexpr bool operator>=(const Money& other) const { return amount >= other.amount; }
+    constexpr bool operator==(const Money& other) const { return amount == other.amount; }
+    constexpr bool operator!=(const Money& other) const { return amount != other.amount; }
 
   
-    Money& operator+=(const Money& other) { amount += other.amount; return *this; }
-    Money& operator-=(const Money& other) { amount -= other.amount; return *this; }
-    Money& operator*=(double factor) { amount = static_cast<T>(amount * factor); return *this; }
-    Money& operator/=(double divisor) { amount = static_cast<T>(amount / divisor); return *this; }
+    constexpr Money& operator+=(const Money& other) { amount += other.amount; return *this; }
+    constexpr Money& operator-=(const Money& other) { amount -= other.amount; return *this; }
+    constexpr Money& operator*=(double factor) { amount = static_cast<T>(amount * factor); return *this; }
+    constexpr Money& operator/=(double divisor) { amount = static_cast<T>(amount / divisor); return *this; }
 
     
     friend std::ostream& operator<<(std::ostream& os, const Money& money) {
@@ -0,0 +1,218 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include "Money.h"
+#include "Taxpayer.h"
+#include "TaxpayerWithPropertyDeduction.h"
+
+struct TaxScenario {
+    double tax_percent = 13.0;
+    double max_property_cost = TaxpayerWithPropertyDeduction<>::MAX_PROPERTY_COST_FOR_DEDUCTION;
+    double deduction_percent = TaxpayerWithPropertyDeduction<>::DEDUCTION_RATE * 100.0;
+};
+
+//     ,    LANE_WIDTH.
+//      LANE_WIDTH   ,
+//     SIMD-;     .
+//     double,         .
+template<typename MoneyType = MoneyWithKopecks>
+class TaxScenarioSweep {
+public:
+#if defined(__AVX512F__)
+    static constexpr size_t LANE_WIDTH = 8;
+#else
+    static constexpr size_t LANE_WIDTH = 4;
+#endif
+
+private:
+    using value_type = typename MoneyType::value_type;
+    static constexpr bool TRUNCATES = std::is_integral_v<value_type>;
+
+    static MoneyType fromTotal(double value);
+    static double scenarioTax(double income, double property, double rate, double cap, double deduction_rate);
+    static void sweepRow(const double* __restrict rates, const double* __restrict caps,
+        const double* __restrict deduction_rates, double income, double property, double baseline,
+        double* __restrict row, double* __restrict totals, size_t padded_count);
+
+    size_t scenario_count;
+    size_t padded_count;
+    std::vector<double> tax_rates;
+    std::vector<double> max_property_costs;
+    std::vector<double> deduction_rates;
+
+    std::vector<double> taxable_incomes;
+    std::vector<double> property_costs;
+
+    std::vector<double> scenario_totals;
+    std::vector<double> taxpayer_deltas;
+
+    void validateTaxpayerIndex(size_t taxpayer) const;
+    void validateScenarioIndex(size_t scenario) const;
+
+public:
+    explicit TaxScenarioSweep(const std::vector<TaxScenario>& scenarios);
+
+    void addTaxpayer(MoneyType taxable_income, MoneyType property_cost = MoneyType(0));
+
+    template<int TaxPercent>
+    void addTaxpayer(const Taxpayer<MoneyType, TaxPercent>& taxpayer);
+
+    void run();
+    void printSummary() const;
+
+    size_t getScenarioCount() const { return scenario_count; }
+    size_t getTaxpayerCount() const { return taxable_incomes.size(); }
+    MoneyType getScenarioTotal(size_t scenario) const;
+    MoneyType getTaxDelta(size_t taxpayer, size_t scenario) const;
+};
+
+
+template<typename MoneyType>
+TaxScenarioSweep<MoneyType>::TaxScenarioSweep(const std::vector<TaxScenario>& scenarios)
+    : scenario_count(scenarios.size()) {
+    if (scenarios.empty()) {
+        throw std::invalid_argument("    ");
+    }
+
+    padded_count = (scenario_count + LANE_WIDTH - 1) / LANE_WIDTH * LANE_WIDTH;
+    tax_rates.assign(padded_count, 0.0);
+    max_property_costs.assign(padded_count, 0.0);
+    deduction_rates.assign(padded_count, 0.0);
+
+    for (size_t k = 0; k < scenario_count; ++k) {
+        const TaxScenario& scenario = scenarios[k];
+        if (!std::isfinite(scenario.tax_percent) || !std::isfinite(scenario.max_property_cost)
+            || !std::isfinite(scenario.deduction_percent)) {
+            throw std::invalid_argument("     ");
+        }
+        if (scenario.tax_percent < 0 || scenario.max_property_cost < 0 || scenario.deduction_percent < 0) {
+            throw std::invalid_argument("     ");
+        }
+        if (scenario.tax_percent > MAX_TAX_PERCENT) {
+            throw std::invalid_argument("       0  99%");
+        }
+        if (scenario.deduction_percent > 100.0) {
+            throw std::invalid_argument("     100%");
+        }
+
+        double max_cost = scenario.max_property_cost;
+        if constexpr (TRUNCATES) {
+            max_cost = std::min(max_cost, static_cast<double>(std::numeric_limits<value_type>::max()));
+        }
+
+        tax_rates[k] = scenario.tax_percent / 100.0;
+        max_property_costs[k] = static_cast<double>(static_cast<value_type>(max_cost));
+        deduction_rates[k] = scenario.deduction_percent / 100.0;
+    }
+}
+
+template<typename MoneyType>
+MoneyType TaxScenarioSweep<MoneyType>::fromTotal(double value) {
+    return MoneyType(static_cast<value_type>(value));
+}
+
+template<typename MoneyType>
+double TaxScenarioSweep<MoneyType>::scenarioTax(double income, double property, double rate,
+    double cap, double deduction_rate) {
+    const value_type base_tax = static_cast<value_type>(income * rate);
+    const value_type deduction = static_cast<value_type>(std::min(property, cap) * deduction_rate);
+    return static_cast<double>(base_tax - std::min(deduction, base_tax));
+}
+
+template<typename MoneyType>
+void TaxScenarioSweep<MoneyType>::sweepRow(const double* __restrict rates, const double* __restrict caps,
+    const double* __restrict deduction_rates, double income, double property, double baseline,
+    double* __restrict row, double* __restrict totals, size_t padded_count) {
+    for (size_t block = 0; block < padded_count; block += LANE_WIDTH) {
+        for (size_t lane = 0; lane < LANE_WIDTH; ++lane) {
+            const size_t k = block + lane;
+            const double tax = scenarioTax(income, property, rates[k], caps[k], deduction_rates[k]);
+            row[k] = tax - baseline;
+            totals[k] += tax;
+        }
+    }
+}
+
+template<typename MoneyType>
+void TaxScenarioSweep<MoneyType>::addTaxpayer(MoneyType taxable_income, MoneyType property_cost) {
+    if (taxable_income < MoneyType(0) || property_cost < MoneyType(0)) {
+        throw std::invalid_argument("    ");
+    }
+    taxable_incomes.push_back(static_cast<double>(taxable_income));
+    property_costs.push_back(static_cast<double>(property_cost));
+    scenario_totals.clear();
+    taxpayer_deltas.clear();
+}
+
+template<typename MoneyType>
+template<int TaxPercent>
+void TaxScenarioSweep<MoneyType>::addTaxpayer(const Taxpayer<MoneyType, TaxPercent>& taxpayer) {
+    auto deducible = dynamic_cast<const TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>*>(&taxpayer);
+    if (deducible) {
+        addTaxpayer(deducible->getTaxableIncome(), deducible->getPropertyCost());
+    }
+    else {
+        addTaxpayer(taxpayer.getTaxableIncome());
+    }
+}
+
+template<typename MoneyType>
+void TaxScenarioSweep<MoneyType>::run() {
+    const size_t taxpayer_count = taxable_incomes.size();
+    scenario_totals.assign(padded_count, 0.0);
+    taxpayer_deltas.assign(taxpayer_count * padded_count, 0.0);
+
+    for (size_t i = 0; i < taxpayer_count; ++i) {
+        const double income = taxable_incomes[i];
+        const double property = property_costs[i];
+        const double baseline = scenarioTax(income, property, tax_rates[0], max_property_costs[0], deduction_rates[0]);
+
+        sweepRow(tax_rates.data(), max_property_costs.data(), deduction_rates.data(),
+            income, property, baseline,
+            taxpayer_deltas.data() + i * padded_count, scenario_totals.data(), padded_count);
+    }
+}
+
+template<typename MoneyType>
+void TaxScenarioSweep<MoneyType>::validateTaxpayerIndex(size_t taxpayer) const {
+    if (taxpayer >= taxpayer_deltas.size() / padded_count) {
+        throw std::out_of_range("  ");
+    }
+}
+
+template<typename MoneyType>
+void TaxScenarioSweep<MoneyType>::validateScenarioIndex(size_t scenario) const {
+    if (scenario >= scenario_count) {
+        throw std::out_of_range("  ");
+    }
+    if (scenario_totals.empty()) {
+        throw std::logic_error("   ");
+    }
+}
+
+template<typename MoneyType>
+MoneyType TaxScenarioSweep<MoneyType>::getScenarioTotal(size_t scenario) const {
+    validateScenarioIndex(scenario);
+    return fromTotal(scenario_totals[scenario]);
+}
+
+template<typename MoneyType>
+MoneyType TaxScenarioSweep<MoneyType>::getTaxDelta(size_t taxpayer, size_t scenario) const {
+    validateScenarioIndex(scenario);
+    validateTaxpayerIndex(taxpayer);
+    return fromTotal(taxpayer_deltas[taxpayer * padded_count + scenario]);
+}
+
+template<typename MoneyType>
+void TaxScenarioSweep<MoneyType>::printSummary() const {
+    std::cout << "\n===    ===" << std::endl;
+    for (size_t k = 0; k < scenario_count; ++k) {
+        std::cout << " " << k + 1 << " (" << tax_rates[k] * 100.0 << "%,  "
+            << fromTotal(max_property_costs[k]) << "): " << getScenarioTotal(k) << std::endl;
+    }
+}
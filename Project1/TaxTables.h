@@ -0,0 +1,41 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include "Money.h"
+#include "Taxpayer.h"
+#include "TaxpayerWithPropertyDeduction.h"
+
+//        ,    Taxpayer,
+//      constexpr-    .
+template<typename MoneyType, int TaxPercent, size_t BandCount>
+class TaxBandTable {
+private:
+    MoneyType band_width;
+    std::array<MoneyType, BandCount> taxes;
+    std::array<MoneyType, BandCount> taxes_with_deduction;
+
+public:
+    constexpr explicit TaxBandTable(MoneyType width, MoneyType property_cost = MoneyType(0))
+        : band_width(width), taxes(), taxes_with_deduction() {
+        using Deduction = TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>;
+
+        if (width <= MoneyType(0)) {
+            throw std::invalid_argument("     ");
+        }
+        Taxpayer<MoneyType, TaxPercent>::validateIncome(property_cost);
+
+        const MoneyType deduction = Deduction::computeDeduction(property_cost);
+        for (size_t band = 0; band < BandCount; ++band) {
+            MoneyType income = width * static_cast<double>(band);
+            MoneyType tax = Taxpayer<MoneyType, TaxPercent>::computeTax(income);
+            taxes[band] = tax;
+            taxes_with_deduction[band] = tax - Deduction::computeDeductionToApply(tax, deduction);
+        }
+    }
+
+    constexpr size_t getBandCount() const { return BandCount; }
+    constexpr MoneyType getBandWidth() const { return band_width; }
+    constexpr MoneyType getTax(size_t band) const { return taxes.at(band); }
+    constexpr MoneyType getTaxWithDeduction(size_t band) const { return taxes_with_deduction.at(band); }
+};
@@ -6,12 +6,16 @@
 #include "ITaxable.h"
 #include "Money.h"
 
+constexpr int MAX_TAX_PERCENT = 99;
+
 template<typename MoneyType = MoneyWithKopecks, int TaxPercent = 13>
 class Taxpayer : public ITaxable {
+    static_assert(TaxPercent >= 0 && TaxPercent <= MAX_TAX_PERCENT, "       0  99%");
+
 protected:
-    static const int INN_LENGTH = 12;
-    static const int MIN_YEAR = 1900;
-    static const int MAX_YEAR = 2100;
+    static constexpr int INN_LENGTH = 12;
+    static constexpr int MIN_YEAR = 1900;
+    static constexpr int MAX_YEAR = 2100;
     static constexpr double TAX_RATE = TaxPercent / 100.0;  
 
     char* inn;
@@ -21,12 +25,14 @@ protected:
     MoneyType tax_amount;
     MoneyType total_income;
 
-    void validateINN(const char* inn) const;
-    void validateYear(int year) const;
-    void validateIncome(MoneyType income) const;
     virtual void calculateTax();
 
 public:
+    static constexpr void validateINN(const char* inn);
+    static constexpr void validateYear(int year);
+    static constexpr void validateIncome(MoneyType income);
+    static constexpr MoneyType computeTax(MoneyType taxable_income);
+    static constexpr MoneyType computeGrossFromNet(MoneyType net_income_after_tax);
    
     Taxpayer(const char* i, int y, MoneyType ti = MoneyType(0.0), MoneyType nti = MoneyType(0.0));
     Taxpayer(const Taxpayer& other);
@@ -108,7 +114,7 @@ Taxpayer<MoneyType, TaxPercent>::~Taxpayer() {
 }
 
 template<typename MoneyType, int TaxPercent>
-void Taxpayer<MoneyType, TaxPercent>::validateINN(const char* inn) const {
+constexpr void Taxpayer<MoneyType, TaxPercent>::validateINN(const char* inn) {
     if (!inn) {
         throw std::invalid_argument("    nullptr");
     }
@@ -130,22 +136,32 @@ void Taxpayer<MoneyType, TaxPercent>::validateINN(const char* inn) const {
 }
 
 template<typename MoneyType, int TaxPercent>
-void Taxpayer<MoneyType, TaxPercent>::validateYear(int year) const {
+constexpr void Taxpayer<MoneyType, TaxPercent>::validateYear(int year) {
     if (year < MIN_YEAR || year > MAX_YEAR) {
         throw std::invalid_argument(" ");
     }
 }
 
 template<typename MoneyType, int TaxPercent>
-void Taxpayer<MoneyType, TaxPercent>::validateIncome(MoneyType income) const {
+constexpr void Taxpayer<MoneyType, TaxPercent>::validateIncome(MoneyType income) {
     if (income < MoneyType(0)) {
         throw std::invalid_argument("    ");
     }
 }
 
+template<typename MoneyType, int TaxPercent>
+constexpr MoneyType Taxpayer<MoneyType, TaxPercent>::computeTax(MoneyType taxable_income) {
+    return taxable_income * TAX_RATE;
+}
+
+template<typename MoneyType, int TaxPercent>
+constexpr MoneyType Taxpayer<MoneyType, TaxPercent>::computeGrossFromNet(MoneyType net_income_after_tax) {
+    return net_income_after_tax / (1 - TAX_RATE);
+}
+
 template<typename MoneyType, int TaxPercent>
 void Taxpayer<MoneyType, TaxPercent>::calculateTax() {
-    tax_amount = taxable_income * TAX_RATE;
+    tax_amount = computeTax(taxable_income);
     total_income = taxable_income + non_taxable_income - tax_amount;
 }
 
@@ -166,14 +182,14 @@ void Taxpayer<MoneyType, TaxPercent>::addIncomeFromNet(MoneyType net_income_afte
     validateIncome(net_income_after_tax);
 
  
-    MoneyType gross_income = net_income_after_tax / (1 - TAX_RATE);
+    MoneyType gross_income = computeGrossFromNet(net_income_after_tax);
 
     taxable_income += gross_income;
     calculateTax();
 
     std::cout << "    : " << net_income_after_tax << std::endl;
     std::cout << "  : " << gross_income << std::endl;
-    std::cout << "    : " << gross_income * TAX_RATE << std::endl;
+    std::cout << "    : " << computeTax(gross_income) << std::endl;
 }
 
 template<typename MoneyType, int TaxPercent>
@@ -12,6 +12,11 @@ private:
     void calculateDeduction();
 
 public:
+    static constexpr double MAX_PROPERTY_COST_FOR_DEDUCTION = 2000000.0;
+    static constexpr double DEDUCTION_RATE = 0.13;
+
+    static constexpr MoneyType computeDeduction(MoneyType property_cost);
+    static constexpr MoneyType computeDeductionToApply(MoneyType base_tax, MoneyType available_deduction);
 
     TaxpayerWithPropertyDeduction(const char* inn, int year,
         MoneyType taxable_income = MoneyType(0.0),
@@ -81,17 +86,29 @@ TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::~TaxpayerWithPropertyDeduc
 }
 
 template<typename MoneyType, int TaxPercent>
-void TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::calculateDeduction() {
-   
-    const MoneyType MAX_PROPERTY_COST_FOR_DEDUCTION(2000000.0);
-    const double DEDUCTION_RATE = 0.13;
+constexpr MoneyType TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::computeDeduction(MoneyType property_cost) {
+    const MoneyType max_cost(MAX_PROPERTY_COST_FOR_DEDUCTION);
 
     MoneyType cost_for_calculation = property_cost;
-    if (cost_for_calculation > MAX_PROPERTY_COST_FOR_DEDUCTION) {
-        cost_for_calculation = MAX_PROPERTY_COST_FOR_DEDUCTION;
+    if (cost_for_calculation > max_cost) {
+        cost_for_calculation = max_cost;
     }
 
-    deduction_amount = cost_for_calculation * DEDUCTION_RATE;
+    return cost_for_calculation * DEDUCTION_RATE;
+}
+
+template<typename MoneyType, int TaxPercent>
+constexpr MoneyType TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::computeDeductionToApply(
+    MoneyType base_tax, MoneyType available_deduction) {
+    if (available_deduction > MoneyType(0) && base_tax > MoneyType(0)) {
+        return (available_deduction < base_tax) ? available_deduction : base_tax;
+    }
+    return MoneyType(0);
+}
+
+template<typename MoneyType, int TaxPercent>
+void TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::calculateDeduction() {
+    deduction_amount = computeDeduction(property_cost);
 }
 template<typename MoneyType, int TaxPercent>
 void TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::setPropertyCost(MoneyType cost) {
@@ -143,18 +160,11 @@ double TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::getNonRefundableTax
 
 template<typename MoneyType, int TaxPercent>
 void TaxpayerWithPropertyDeduction<MoneyType, TaxPercent>::calculateTax() {
-    MoneyType base_tax = this->taxable_income * this->TAX_RATE;
-
-    MoneyType available_deduction = deduction_amount - used_deduction;
+    MoneyType base_tax = this->computeTax(this->taxable_income);
 
-    if (available_deduction > MoneyType(0) && base_tax > MoneyType(0)) {
-        MoneyType deduction_to_apply = (available_deduction < base_tax) ? available_deduction : base_tax;
-        this->tax_amount = base_tax - deduction_to_apply;
-        used_deduction += deduction_to_apply;
-    }
-    else {
-        this->tax_amount = base_tax;
-    }
+    MoneyType deduction_to_apply = computeDeductionToApply(base_tax, deduction_amount - used_deduction);
+    this->tax_amount = base_tax - deduction_to_apply;
+    used_deduction += deduction_to_apply;
 
     this->total_income = this->taxable_income + this->non_taxable_income - this->tax_amount;
 }
@@ -8,9 +8,20 @@
 #include "Money.h"
 #include "Taxpayer.h"
 #include "TaxpayerWithPropertyDeduction.h"
+#include "TaxScenarioSweep.h"
+#include "TaxTables.h"
 
 using namespace std;
 
+static_assert((Taxpayer<>::validateINN("123456789012"), true));
+static_assert(Taxpayer<MoneyWithoutKopecks, 13>::computeTax(MoneyWithoutKopecks(100000)) == MoneyWithoutKopecks(13000));
+static_assert(Taxpayer<MoneyWithoutKopecks, 20>::computeGrossFromNet(MoneyWithoutKopecks(80000)) == MoneyWithoutKopecks(100000));
+static_assert(TaxpayerWithPropertyDeduction<MoneyWithoutKopecks, 13>::computeDeduction(MoneyWithoutKopecks(3000000)) == MoneyWithoutKopecks(260000));
+
+constexpr TaxBandTable<MoneyWithoutKopecks, 13, 6> TAX_BY_INCOME_BAND(MoneyWithoutKopecks(500000), MoneyWithoutKopecks(2000000));
+static_assert(TAX_BY_INCOME_BAND.getTax(2) == MoneyWithoutKopecks(130000));
+static_assert(TAX_BY_INCOME_BAND.getTaxWithDeduction(2) == MoneyWithoutKopecks(0));
+
 void clearInputBuffer() {
     cin.clear();
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
@@ -100,6 +111,96 @@ void demonstrateDifferentTaxRates() {
     taxpayer20.printTaxInfo();
 }
 
+void demonstrateScenarioSweep() {
+    cout << "\n===      ===" << endl;
+
+    TaxScenarioSweep<MoneyWithKopecks> sweep({
+        { 13.0, 2000000.0, 13.0 },
+        { 15.0, 2000000.0, 13.0 },
+        { 20.0, 2000000.0, 13.0 },
+        { 13.0, 3000000.0, 13.0 },
+        { 15.0, 1000000.0, 13.0 } });
+
+    Taxpayer<MoneyWithKopecks, 13> taxpayer("333333333333", 2024, MoneyWithKopecks(500000));
+    TaxpayerWithPropertyDeduction<MoneyWithKopecks, 13> taxpayerWithDeduction(
+        "444444444444", 2024,
+        MoneyWithKopecks(1000000.50),
+        MoneyWithKopecks(200000.75),
+        MoneyWithKopecks(3000000.25));
+
+    TaxpayerWithPropertyDeduction<MoneyWithKopecks, 13> highIncomeTaxpayer(
+        "555555555555", 2024,
+        MoneyWithKopecks(2500000.0),
+        MoneyWithKopecks(0.0),
+        MoneyWithKopecks(1500000.0));
+
+    sweep.addTaxpayer(taxpayer);
+    sweep.addTaxpayer(taxpayerWithDeduction);
+    sweep.addTaxpayer(highIncomeTaxpayer);
+
+    sweep.run();
+    sweep.printSummary();
+
+    MoneyWithKopecks expectedTotal;
+    expectedTotal += taxpayer;
+    expectedTotal += taxpayerWithDeduction;
+    expectedTotal += highIncomeTaxpayer;
+    if (sweep.getScenarioTotal(0) != expectedTotal) {
+        throw logic_error("  1      ( )");
+    }
+
+    TaxScenarioSweep<MoneyWithoutKopecks> sweepWithoutKopecks({ { 13.0, 2000000.0, 13.0 } });
+    Taxpayer<MoneyWithoutKopecks, 13> taxpayerWithoutKopecks("666666666666", 2024, MoneyWithoutKopecks(100001));
+    TaxpayerWithPropertyDeduction<MoneyWithoutKopecks, 13> taxpayerWithDeductionWithoutKopecks(
+        "777777777777", 2024,
+        MoneyWithoutKopecks(3000007),
+        MoneyWithoutKopecks(0),
+        MoneyWithoutKopecks(1999999));
+
+    sweepWithoutKopecks.addTaxpayer(taxpayerWithoutKopecks);
+    const Taxpayer<MoneyWithoutKopecks, 13>& taxpayerByBase = taxpayerWithDeductionWithoutKopecks;
+    sweepWithoutKopecks.addTaxpayer(taxpayerByBase);
+    sweepWithoutKopecks.run();
+
+    MoneyWithoutKopecks expectedTotalWithoutKopecks;
+    expectedTotalWithoutKopecks += taxpayerWithoutKopecks;
+    expectedTotalWithoutKopecks += taxpayerWithDeductionWithoutKopecks;
+    if (sweepWithoutKopecks.getScenarioTotal(0) != expectedTotalWithoutKopecks) {
+        throw logic_error("  1      ( )");
+    }
+    cout << "\n  1    ." << endl;
+
+    cout << "\n---     1 ---" << endl;
+    for (size_t i = 0; i < sweep.getTaxpayerCount(); i++) {
+        cout << " " << i + 1 << ":";
+        for (size_t k = 1; k < sweep.getScenarioCount(); k++) {
+            cout << " " << sweep.getTaxDelta(i, k);
+        }
+        cout << endl;
+    }
+}
+
+void demonstrateCompileTimeTables() {
+    cout << "\n=== ,    ===" << endl;
+
+    cout << "\n---     (13%,  2000000 .) ---" << endl;
+    for (size_t band = 0; band < TAX_BY_INCOME_BAND.getBandCount(); band++) {
+        cout << " " << TAX_BY_INCOME_BAND.getBandWidth() * static_cast<double>(band)
+            << ":  " << TAX_BY_INCOME_BAND.getTax(band)
+            << ",   " << TAX_BY_INCOME_BAND.getTaxWithDeduction(band) << endl;
+    }
+
+    constexpr MoneyWithKopecks net(100000.0);
+    constexpr MoneyWithKopecks gross13 = Taxpayer<MoneyWithKopecks, 13>::computeGrossFromNet(net);
+    constexpr MoneyWithKopecks gross15 = Taxpayer<MoneyWithKopecks, 15>::computeGrossFromNet(net);
+    constexpr MoneyWithKopecks gross20 = Taxpayer<MoneyWithKopecks, 20>::computeGrossFromNet(net);
+
+    cout << "\n---     " << net << "   ---" << endl;
+    cout << "13%: " << gross13 << endl;
+    cout << "15%: " << gross15 << endl;
+    cout << "20%: " << gross20 << endl;
+}
+
 void demonstratePolymorphismWithTemplates() {
     cout << "\n===     ===" << endl;
 
@@ -217,6 +318,10 @@ int main() {
 
         demonstrateDifferentTaxRates();
 
+        demonstrateScenarioSweep();
+
+        demonstrateCompileTimeTables();
+
    
         demonstratePolymorphismWithTemplates();
 